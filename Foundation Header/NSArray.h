@@ -193,6 +193,10 @@ NSArray *array = [NSArray arrayWithObjects:,nil];
 
 /****************	Mutable Array		****************/
 
+// NSMutableArray 的存储是一个环形缓冲区(ring buffer / deque)：
+// 在头部或尾部插入、删除(insertObject:atIndex:0、removeObjectAtIndex:0、addObject:、removeLastObject)都是均摊 O(1)，不需要 memmove;
+// 在中间插入、删除时只移动离端点较近的那一侧元素，最多移动 count/2 个。
+// countByEnumeratingWithState:objects:count: 每次返回的仍是一段连续内存，缓冲区发生回绕时枚举分两批返回。
 @interface NSMutableArray<ObjectType> : NSArray<ObjectType>
 
 - (void)addObject:(ObjectType)anObject;
@@ -233,6 +237,9 @@ NSArray *array = [NSArray arrayWithObjects:,nil];
 - (void)sortUsingComparator:(NSComparator)cmptr NS_AVAILABLE(10_6, 4_0);
 - (void)sortWithOptions:(NSSortOptions)opts usingComparator:(NSComparator)cmptr NS_AVAILABLE(10_6, 4_0);
 
+// 删除第一个元素，等价于 removeObjectAtIndex:0，均摊 O(1)；数组为空时与 removeObjectAtIndex: 一样抛出 NSRangeException
+- (void)removeFirstObject NS_AVAILABLE(10_11, 9_0);
+
 @end
 
 @interface NSMutableArray<ObjectType> (NSMutableArrayCreation)
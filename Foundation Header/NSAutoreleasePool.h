@@ -6,6 +6,26 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/* Autoreleased objects are stored in per-thread 4 KB pages. Creating a pool pushes a boundary marker onto the current thread's hot page, and draining it releases every object above that marker in one pass; both are pointer bumps in the common case.
+*/
+
+typedef struct {
+    NSUInteger depth;		// number of pools still open on the thread after the pop
+    NSUInteger objectsDrained;	// objects released by this pop
+    NSUInteger highWaterObjects;	// largest number of pending autoreleased objects seen on the thread (objects, not pool depth)
+    const void * __nullable returnAddress;	// caller of the pop, for attributing leaks to a loop
+} NSAutoreleasePoolDrainInfo;
+
+typedef void (*NSAutoreleasePoolDrainHook)(const NSAutoreleasePoolDrainInfo *info);
+
+// Installs a hook called on the draining thread after every pool pop; pass NULL to remove it. Returns the previous hook.
+FOUNDATION_EXPORT NSAutoreleasePoolDrainHook __nullable NSSetAutoreleasePoolDrainHook(NSAutoreleasePoolDrainHook __nullable hook) NS_AVAILABLE(10_11, 9_0);
+
+// Largest number of pending autoreleased objects seen on the current thread, as in highWaterObjects. Usable from ARC code, which only has @autoreleasepool.
+FOUNDATION_EXPORT NSUInteger NSAutoreleasePoolGetHighWaterObjects(void) NS_AVAILABLE(10_11, 9_0);
+// Resets the calling thread's high-water mark to its current number of pending objects; other threads are unaffected.
+FOUNDATION_EXPORT void NSAutoreleasePoolResetHighWaterObjects(void) NS_AVAILABLE(10_11, 9_0);
+
 NS_AUTOMATED_REFCOUNT_UNAVAILABLE
 @interface NSAutoreleasePool : NSObject {
 @private
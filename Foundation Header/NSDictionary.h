@@ -11,6 +11,10 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/*  Dictionaries are open-addressed hash tables.  Each slot has a control byte holding 7 bits of the key's hash (or an empty/deleted marker); lookups compare 16 control bytes at a time with SIMD, and the key's full hash, cached next to it, is compared before -isEqual: is sent.  So -isEqual: is only sent to keys whose hash matches, and -hash is sent once per key on insertion, never again when the table grows.
+ Immutable dictionaries, including those created with +dictionaryWithObjects:forKeys:count:, keep their control bytes, hashes, keys and objects in a single allocation together with the dictionary object.
+ As for any usage of hashing, the hash codes must satisfy the hash/isEqual: invariant and must not change while the key is in the dictionary.
+ */
 @interface NSDictionary<__covariant KeyType, __covariant ObjectType> : NSObject <NSCopying, NSMutableCopying, NSSecureCoding, NSFastEnumeration>
 
 @property (readonly) NSUInteger count;
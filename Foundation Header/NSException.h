@@ -53,7 +53,7 @@ __attribute__((__objc_exception__))
 @property (nullable, readonly, copy) NSDictionary *userInfo;
 
 @property (readonly, copy) NSArray<NSNumber *> *callStackReturnAddresses NS_AVAILABLE(10_5, 2_0);
-@property (readonly, copy) NSArray<NSString *> *callStackSymbols NS_AVAILABLE(10_6, 4_0);
+@property (readonly, copy) NSArray<NSString *> *callStackSymbols NS_AVAILABLE(10_6, 4_0);	// symbolicated from the return addresses on first access, not when raised
 
 - (void)raise;
 
@@ -21,6 +21,12 @@ The following code snippets can be used to enumerate over the indexes in an NSIn
     }
 
 To enumerate without doing a call per index, you can use the method getIndexes:maxCount:inIndexRange:.
+
+Storage: an index set that is not a single range is a compressed (roaring) bitmap.  The index space is split into chunks of 65536 indexes, and each non-empty chunk uses whichever container is smallest for its contents:
+    - an array of 16-bit offsets, for up to 4096 indexes (2 bytes per index);
+    - a 65536-bit bitmap, for denser chunks (8 KB per chunk);
+    - a list of runs (start, length), for clustered indexes (4 bytes per run).
+Containers are re-chosen as indexes are added or removed, so sparse, dense, alternating and run-heavy sets all stay compact.  addIndexes:, removeIndexes:, intersectIndexes:, containsIndexes: and isEqualToIndexSet: work chunk by chunk, with SIMD kernels for bitmap and array containers.
 */
 
 #import <Foundation/NSObject.h>
@@ -94,7 +100,7 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSIndexSet *)indexesInRange:(NSRange)range options:(NSEnumerationOptions)opts passingTest:(BOOL (^)(NSUInteger idx, BOOL *stop))predicate NS_AVAILABLE(10_6, 4_0);
 
 /*
- The following three convenience methods allow you to enumerate the indexes in the receiver by ranges of contiguous indexes. The performance of these methods is not guaranteed to be any better than if they were implemented with enumerateIndexesInRange:options:usingBlock:. However, depending on the receiver's implementation, they may perform better than that.
+ The following three convenience methods allow you to enumerate the indexes in the receiver by ranges of contiguous indexes. The performance of these methods is not guaranteed to be any better than if they were implemented with enumerateIndexesInRange:options:usingBlock:. However, depending on the receiver's implementation, they may perform better than that; run containers are enumerated one run per block call, and bitmap containers a word at a time.
  
  If the specified range for enumeration intersects a range of contiguous indexes in the receiver, then the block will be invoked with the intersection of those two ranges.
 */
@@ -117,6 +123,10 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)addIndexesInRange:(NSRange)range;
 - (void)removeIndexesInRange:(NSRange)range;
 
+/* Removes every index that is not also in indexSet.
+*/
+- (void)intersectIndexes:(NSIndexSet *)indexSet NS_AVAILABLE(10_11, 9_0);
+
 /* For a positive delta, shifts the indexes in [index, INT_MAX] to the right, thereby inserting an "empty space" [index, delta], for a negative delta, shifts the indexes in [index, INT_MAX] to the left, thereby deleting the indexes in the range [index - delta, delta].
 */
 - (void)shiftIndexesStartingAtIndex:(NSUInteger)index by:(NSInteger)delta;   
@@ -13,6 +13,11 @@
 
 NS_ASSUME_NONNULL_BEGIN
 
+/*  An ordered set stores its members in a dense array, plus an open-addressed hash index that maps each member (by -hash and -isEqual:) to its position in the array.  -indexOfObject: and -containsObject: are a single index lookup, O(1) on average.
+ The index is updated incrementally: appending or removing the last member touches one index entry.  Inserting or removing a member at index i shifts every later member, so it updates count - i index entries, O(n) at the front.  Moving a member from index i to index j updates only the |i - j| + 1 members between the two locations.
+ -intersectsOrderedSet:, -intersectOrderedSet: and -minusOrderedSet: iterate the smaller of the two sets and probe the index of the other.  -unionOrderedSet: iterates only the argument, and -isSubsetOfOrderedSet: returns NO without iterating when the receiver has more members.
+ Memory: on 64-bit, each member costs one 8-byte array slot plus one 16-byte index slot (cached hash and position), and the index is kept between 1/2 and 7/8 full, so an ordered set uses about 26 to 40 bytes per member, compared with 8 for an NSArray.
+ */
 NS_CLASS_AVAILABLE(10_7, 5_0)
 @interface NSOrderedSet<__covariant ObjectType> : NSObject <NSCopying, NSMutableCopying, NSSecureCoding, NSFastEnumeration>
 
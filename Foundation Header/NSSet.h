@@ -144,6 +144,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 /****************	Counted Set	****************/
 
+// NSCountedSet 使用专用的哈希表：计数以整数形式紧挨着 key 存放在同一个槽位里，不再为每个元素单独装箱一个计数对象。
 @interface NSCountedSet<ObjectType> : NSMutableSet<ObjectType> {
     @private
     id _table;
@@ -171,6 +172,19 @@ NS_ASSUME_NONNULL_BEGIN
 - (void)removeObject:(ObjectType)object;
 // [set removeObject:obj];
 
+// 将某个对象的计数一次增加 count，等价于调用 count 次 addObject:
+- (void)addObject:(ObjectType)object count:(NSUInteger)count NS_AVAILABLE(10_11, 9_0);
+// [countedSet addObject:event count:3];
+
+// 一次遍历批量添加 C 数组中的对象，重复出现的对象计数累加
+- (void)addObjects:(const ObjectType [])objects count:(NSUInteger)cnt NS_AVAILABLE(10_11, 9_0);
+// [countedSet addObjects:buffer count:n];
+
+// 合并另一个计数集合：otherSet 中每个对象的计数累加到当前集合(unionSet: 只会把每个对象加一次)。
+// 可用于并行聚合时合并各线程各自的 NSCountedSet。
+- (void)unionCountedSet:(NSCountedSet<ObjectType> *)otherSet NS_AVAILABLE(10_11, 9_0);
+// [total unionCountedSet:perThreadSet];
+
 @end
 
 NS_ASSUME_NONNULL_END
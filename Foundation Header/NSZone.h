@@ -11,6 +11,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 typedef struct _NSZone NSZone;
 
+/* Zones other than the default malloc zone are region-based arenas.  NSCreateZone reserves a first region of startSize bytes and grows by regions of granularity bytes; NSZoneMalloc and NSZoneCalloc bump-allocate within the current region.  If canFree is NO, NSZoneFree is a no-op and memory is only returned by NSRecycleZone, which releases every region of the zone at once regardless of how many blocks were allocated.  If canFree is YES, each block carries a size header; NSZoneFree rewinds the bump pointer when given the most recently allocated block, and otherwise puts the block on the zone's free list for its size class, which NSZoneMalloc and NSZoneCalloc consult before bumping.  Regions are still only released by NSRecycleZone.  NSZoneRealloc grows or shrinks a block in place when it is the last block of its region and the region has room; otherwise it allocates a new block, copies, and frees the old one as NSZoneFree would (so with canFree NO the old block stays allocated until NSRecycleZone).  NSZoneGetStatistics with a NULL zone describes the default malloc zone: regionCount is 0, bytesReserved is the memory the malloc zone has obtained from the system, and bytesAllocated is the memory in use.  NSZoneFromPointer resolves any pointer into a zone region through an address-range index, and returns the default malloc zone for other heap pointers.
+*/
+
+typedef struct {
+    NSUInteger regionCount;
+    NSUInteger bytesReserved;	// total size of the zone's regions
+    NSUInteger bytesAllocated;	// bytes handed out and not freed
+} NSZoneStatistics;
+
 FOUNDATION_EXPORT NSZone *NSDefaultMallocZone(void) NS_SWIFT_UNAVAILABLE("Zone-based memory management is unavailable");
 FOUNDATION_EXPORT NSZone *NSCreateZone(NSUInteger startSize, NSUInteger granularity, BOOL canFree) NS_SWIFT_UNAVAILABLE("Zone-based memory management is unavailable");
 FOUNDATION_EXPORT void NSRecycleZone(NSZone *zone)NS_SWIFT_UNAVAILABLE("Zone-based memory management is unavailable");
@@ -23,6 +32,7 @@ FOUNDATION_EXPORT void *NSZoneMalloc(NSZone * __nullable zone, NSUInteger size)
 FOUNDATION_EXPORT void *NSZoneCalloc(NSZone * __nullable zone, NSUInteger numElems, NSUInteger byteSize) NS_SWIFT_UNAVAILABLE("Zone-based memory management is unavailable");
 FOUNDATION_EXPORT void *NSZoneRealloc(NSZone * __nullable zone, void * __nullable ptr, NSUInteger size) NS_SWIFT_UNAVAILABLE("Zone-based memory management is unavailable");
 FOUNDATION_EXPORT void NSZoneFree(NSZone * __nullable zone, void *ptr) NS_SWIFT_UNAVAILABLE("Zone-based memory management is unavailable");
+FOUNDATION_EXPORT void NSZoneGetStatistics(NSZone * __nullable zone, NSZoneStatistics *statistics) NS_AVAILABLE(10_11, 9_0) NS_SWIFT_UNAVAILABLE("Zone-based memory management is unavailable");
 
 #if (TARGET_OS_MAC && !(TARGET_OS_EMBEDDED || TARGET_OS_IPHONE))
 
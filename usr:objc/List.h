@@ -37,6 +37,24 @@
 #include <objc/Object.h>
 #include <Availability.h>
 
+/*
+ * Storage.  dataPtr always points to a malloc'd buffer, so existing code that
+ * frees or reallocates dataPtr or NX_ADDRESS(list) keeps working.  When the
+ * buffer fills it grows geometrically (doubling) rather than by a fixed
+ * amount, so appends are amortized constant time; -setAvailableCapacity:
+ * still sets the capacity exactly.
+ * A List sent -setUsesIndex:YES additionally keeps an identity hash index
+ * in a side table once it holds more than NX_LIST_INDEX_THRESHOLD elements;
+ * indexOf:, addObjectIfAbsent:, removeObject: and replaceObject:with: then
+ * consult it instead of searching linearly.  The index is off by default.
+ * It is rebuilt whenever dataPtr or numElements differ from what the List
+ * last recorded, but an element stored directly through dataPtr or
+ * NX_ADDRESS is not seen, so only enable it for lists modified solely
+ * through List methods.  -copyFromZone: does not copy the index or the
+ * setting, and -free releases the index with the List.
+ */
+#define NX_LIST_INDEX_THRESHOLD	64
+
 DEPRECATED_ATTRIBUTE
 @interface List : Object
 {
@@ -84,6 +102,7 @@ DEPRECATED_ATTRIBUTE
 - (id)addObjectIfAbsent:anObject  DEPRECATED_ATTRIBUTE;
 - (id)removeObject:anObject  DEPRECATED_ATTRIBUTE;
 - (id)replaceObject:anObject with:newObject  DEPRECATED_ATTRIBUTE;
+- (id)setUsesIndex:(BOOL)flag  DEPRECATED_ATTRIBUTE;
 
 /* Emptying the list */
 
@@ -33,6 +33,8 @@
 
 - (BOOL)respondsToSelector:(SEL)aSelector;
 
+// With OBJC_PACKED_ISA, retain/release update a count stored inline in the
+// isa word with an atomic compare-and-swap, and use the side table only on overflow.
 - (instancetype)retain OBJC_ARC_UNAVAILABLE;
 - (oneway void)release OBJC_ARC_UNAVAILABLE;
 - (instancetype)autorelease OBJC_ARC_UNAVAILABLE;
@@ -37,7 +37,6 @@
 
 #include <objc/objc.h>
 #include <stdint.h>
-#include <TargetConditionals.h>
 
 __BEGIN_DECLS
 
@@ -47,7 +46,8 @@ __BEGIN_DECLS
 
 /* This module allows hashing of arbitrary data.  Such data must be pointers or integers, and client is responsible for allocating/deallocating this data.  A deallocation call-back is provided.
 The objective C class HashTable is preferred when dealing with (key, values) associations because it is easier to use in that situation.
-As well-behaved scalable data structures, hash tables double in size when they start becoming full, thus guaranteeing both average constant time access and linear size. */
+As well-behaved scalable data structures, hash tables double in size when they start becoming full, thus guaranteeing both average constant time access and linear size.
+Tables are open-addressed: each slot has a control byte holding 7 bits of the element's hash (or an empty/deleted marker), and lookups compare a group of 16 control bytes at once (with SSE2 where available) before calling isEqual, so isEqual is only called for elements whose 7 hash bits match.  The hash call-back is still called once per lookup, and once per element when the table grows. */
 
 typedef struct {
     uintptr_t	(*hash)(const void *info, const void *data);
@@ -72,6 +72,7 @@ typedef struct {
     const void			*info OBJC_HASH_AVAILABILITY;
    } NXHashTable OBJC_HASH_AVAILABILITY;
     /* private data structure; may change */
+    /* nbBuckets is the number of slots, always a power of 2 and a multiple of 16; buckets points to the nbBuckets control bytes, followed by the nbBuckets data pointers */
     
 OBJC_EXPORT NXHashTable *NXCreateHashTableFromZone (NXHashTablePrototype prototype, unsigned capacity, const void *info, void *z) OBJC_HASH_AVAILABILITY;
 OBJC_EXPORT NXHashTable *NXCreateHashTable (NXHashTablePrototype prototype, unsigned capacity, const void *info) OBJC_HASH_AVAILABILITY;
@@ -139,6 +140,7 @@ OBJC_EXPORT void *NXHashRemove (NXHashTable *table, const void *data) OBJC_HASH_
 
 typedef struct {int i; int j;} NXHashState OBJC_HASH_AVAILABILITY;
     /* callers should not rely on actual contents of the struct */
+    /* elements are visited in slot order; removing the element just returned by NXNextHashState does not disturb the iteration */
 
 OBJC_EXPORT NXHashState NXInitHashState(NXHashTable *table) OBJC_HASH_AVAILABILITY;
 
@@ -190,7 +192,8 @@ OBJC_EXPORT const NXHashTablePrototype NXStrStructKeyPrototype OBJC_HASH_AVAILAB
  *************************************************************************/
 
 /* Unique strings allows C users to enjoy the benefits of Lisp's atoms:
-A unique string is a string that is allocated once for all (never de-allocated) and that has only one representant (thus allowing comparison with == instead of strcmp).  A unique string should never be modified (and in fact some memory protection is done to ensure that).  In order to more explicitly insist on the fact that the string has been uniqued, a synonym of (const char *) has been added, NXAtom. */
+A unique string is a string that is allocated once for all (never de-allocated) and that has only one representant (thus allowing comparison with == instead of strcmp).  A unique string should never be modified (and in fact some memory protection is done to ensure that).  In order to more explicitly insist on the fact that the string has been uniqued, a synonym of (const char *) has been added, NXAtom.
+The atom table is split into shards selected by the string's hash.  Looking up a string that is already unique takes no lock and is safe from any thread; only the insertion of a new string locks its shard.  Copied strings are bump-allocated in a per-shard arena, so unique strings sit contiguously in memory; arenas only ever grow and are never released, so no unique string is ever freed. */
 
 typedef const char *NXAtom OBJC_HASH_AVAILABILITY;
 
@@ -212,6 +215,19 @@ OBJC_EXPORT NXAtom NXUniqueStringNoCopy(const char *string) OBJC_HASH_AVAILABILI
     /* If there is already a unique string equal to string, returns the original.  
     Otherwise, string is entered in the table, without making a copy.  Argument should then never be modified.  */
 	
+typedef struct {
+    size_t	atomCount;		/* number of unique strings */
+    size_t	arenaBytes;		/* bytes reserved by the shard arenas */
+    size_t	arenaBytesUsed;		/* bytes holding unique string text */
+    size_t	shardCount;
+    size_t	shardContention;	/* insertions that had to wait for a shard lock */
+    } NXUniqueStringStatistics;
+
+OBJC_EXPORT void NXGetUniqueStringStatistics(NXUniqueStringStatistics *statistics) __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_NA);
+    /* fills statistics with a snapshot of the unique string table.
+    Counters are read without stopping concurrent insertions, so fields
+    may be mutually inconsistent by a few strings. */
+
 OBJC_EXPORT char *NXCopyStringBuffer(const char *buffer) OBJC_HASH_AVAILABILITY;
     /* given a buffer, allocates a new string copy of buffer.  
     Buffer should be \0 terminated; returned string is \0 terminated. */
@@ -273,6 +273,84 @@ OBJC_EXPORT void _objc_msgForward_stret(id receiver, SEL sel, ...)
 #endif
 
 
+/* Dispatch Sampling
+ *
+ * An opt-in profiler for objc_msgSend and method_invoke. While sampling is 
+ * enabled, one message in every samplePeriod records its (class, selector) 
+ * pair, and messages that fall back to _objc_msgForward are counted separately.
+ * Samples go to a per-thread buffer and are merged only when a profile is 
+ * copied or written.
+ *
+ * While sampling is disabled the dispatch path pays for a single, 
+ * well-predicted branch on a global flag.
+ */
+
+/// One entry of a merged dispatch profile.
+typedef struct objc_dispatch_sample {
+    __unsafe_unretained Class cls;  /**< The class of the receiver. */
+    SEL sel;                        /**< The selector sent. */
+    unsigned long long count;       /**< Sampled messages with this class and selector. */
+    unsigned long long forwarded;   /**< How many of those went through \c _objc_msgForward. */
+} objc_dispatch_sample_t;
+
+/// Output formats for \c objc_dispatchProfileWrite.
+typedef OBJC_ENUM(int, objc_dispatch_profile_format) {
+    /// One line per (class, selector): count, forwarded count, then \c -[Class selector].
+    OBJC_DISPATCH_PROFILE_FLAT = 0,
+    /// Folded stacks (\c frame;frame count), one line per sampled call stack, for flame graph tools.
+    OBJC_DISPATCH_PROFILE_FOLDED = 1
+};
+
+/** 
+ * Starts sampling message dispatch on all threads.
+ * 
+ * @param samplePeriod Record one message in every \e samplePeriod per thread. 
+ *  Pass 1 to record every message. Passing 0 is the same as calling 
+ *  \c objc_dispatchProfileStop.
+ * 
+ * @note Folded-stack output needs call stacks, which are only captured 
+ *  when \e samplePeriod is at least 64.
+ */
+OBJC_EXPORT void objc_dispatchProfileStart(unsigned int samplePeriod)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Stops sampling message dispatch. Samples already recorded are kept.
+ */
+OBJC_EXPORT void objc_dispatchProfileStop(void)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Discards every sample recorded so far.
+ */
+OBJC_EXPORT void objc_dispatchProfileReset(void)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Merges the per-thread sample buffers into a flat profile.
+ * 
+ * @param outCount On return, the number of entries in the returned array.
+ * 
+ * @return An array of samples ordered by decreasing \e count, or \c NULL if nothing 
+ *  was sampled. You must free the array with \c free().
+ */
+OBJC_EXPORT objc_dispatch_sample_t *objc_dispatchProfileCopySamples(unsigned int *outCount)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Merges the per-thread sample buffers and writes them to a file descriptor.
+ * 
+ * @param fd The file descriptor to write to.
+ * @param format The output format.
+ * 
+ * @return 0 on success, or an \c errno value if writing failed. Returns \c EINVAL without 
+ *  writing anything if \e format is \c OBJC_DISPATCH_PROFILE_FOLDED and no call stacks 
+ *  were captured, e.g. because every sample was taken with \e samplePeriod below 64.
+ */
+OBJC_EXPORT int objc_dispatchProfileWrite(int fd, objc_dispatch_profile_format format)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+
 /* Variable-argument Messaging Primitives
  *
  * Use these functions to call methods with a list of arguments, such 
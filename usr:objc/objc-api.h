@@ -25,9 +25,31 @@
 #ifndef _OBJC_OBJC_API_H_
 #define _OBJC_OBJC_API_H_
 
+#if defined(__APPLE__)
 #include <Availability.h>
 #include <AvailabilityMacros.h>
 #include <TargetConditionals.h>
+#else
+/* Non-Darwin builds (e.g. the portable runtime on Linux) have no SDK
+ * availability headers. Availability annotations are ignored there and
+ * every TARGET_OS_* conditional evaluates to 0. */
+#include <stddef.h>     // for NULL, which nil and Nil expand to
+#   ifndef __OSX_AVAILABLE_STARTING
+#       define __OSX_AVAILABLE_STARTING(_mac, _iphone)
+#   endif
+#   ifndef __OSX_AVAILABLE_BUT_DEPRECATED
+#       define __OSX_AVAILABLE_BUT_DEPRECATED(_macIntro, _macDep, _iphoneIntro, _iphoneDep)
+#   endif
+#   ifndef __OSX_AVAILABLE_BUT_DEPRECATED_MSG
+#       define __OSX_AVAILABLE_BUT_DEPRECATED_MSG(_macIntro, _macDep, _iphoneIntro, _iphoneDep, _msg)
+#   endif
+#   ifndef UNAVAILABLE_ATTRIBUTE
+#       define UNAVAILABLE_ATTRIBUTE __attribute__((unavailable))
+#   endif
+#   ifndef DEPRECATED_ATTRIBUTE
+#       define DEPRECATED_ATTRIBUTE __attribute__((deprecated))
+#   endif
+#endif
 
 #ifndef __has_feature
 #   define __has_feature(x) 0
@@ -92,10 +114,34 @@
 #endif
 
 
+/* OBJC_PACKED_ISA 1: the isa field of an object is a packed word holding
+ * the class pointer, the inline retain count, and the has-associated-objects,
+ * has-weak-refs and deallocating flags. Use object_getClass() to read the class.
+ * OBJC_PACKED_ISA 0: isa is a plain class pointer and retain counts live in
+ * the side table.
+ * The runtime's own build (objc-private.h) may define it to choose the layout; 
+ * clients may not. The defaults below describe the layout of the runtimes that 
+ * ship with this header, so a runtime built with a different setting must ship 
+ * a header with different defaults. */
+#if !defined(_OBJC_PRIVATE_H_)
+#   if defined(OBJC_PACKED_ISA)
+#       error OBJC_PACKED_ISA is determined by the runtime and must not be defined
+#   endif
+#endif
+#if !defined(OBJC_PACKED_ISA)
+#   if __LP64__
+#       define OBJC_PACKED_ISA 1
+#   else
+#       define OBJC_PACKED_ISA 0
+#   endif
+#endif
+
+
 /* OBJC_ISA_AVAILABILITY: `isa` will be deprecated or unavailable 
- * in the future */
+ * in the future. A packed isa is not a class pointer, so reading 
+ * it directly is deprecated in every mode. */
 #if !defined(OBJC_ISA_AVAILABILITY)
-#   if __OBJC2__
+#   if __OBJC2__  ||  OBJC_PACKED_ISA
 #       define OBJC_ISA_AVAILABILITY  __attribute__((deprecated))
 #   else
 #       define OBJC_ISA_AVAILABILITY  /* still available */
@@ -58,8 +58,31 @@ enum {
     
     OBJC_COLLECT_IF_NEEDED       = (1 << 3), // run collection only if needed (allocation threshold exceeded)
     OBJC_WAIT_UNTIL_DONE         = (1 << 4), // wait (when possible) for collection to end before returning (when collector is running on dedicated thread)
+    OBJC_INCREMENTAL_COLLECTION  = (1 << 5), // run the collection as incremental tri-color marking slices bounded by the slice budget
 };
 
+/* OBJC_INCREMENTAL_COLLECTION combines with OBJC_RATIO_COLLECTION, OBJC_GENERATIONAL_COLLECTION 
+ * or OBJC_FULL_COLLECTION, which still choose the generation collected; it is ignored with 
+ * OBJC_EXHAUSTIVE_COLLECTION, which always stops the world.  objc_collect() runs the first slice 
+ * on the calling thread and returns; the collector's dedicated thread runs the remaining slices, 
+ * each bounded by the slice budget, while other threads keep running.  With OBJC_WAIT_UNTIL_DONE 
+ * the caller blocks until the cycle finishes, but only the caller.  objc_collectSlice() advances 
+ * the same cycle from the calling thread, e.g. when idle. */
+
+/* Statistics for one completed collection cycle */
+typedef struct {
+    uint64_t cycle;                  // sequence number of the cycle
+    unsigned long options;           // objc_collect() options the cycle ran with
+    uint32_t slices;                 // number of pauses; 1 for a stop-the-world collection
+    uint64_t totalPauseNanoseconds;  // sum of all pauses
+    uint64_t maxPauseNanoseconds;    // longest single pause
+    size_t heapSizeBefore;           // collectable bytes in use when the cycle started
+    size_t heapSizeAfter;            // collectable bytes in use when the cycle finished
+    size_t collectedGenerationBytes; // bytes in the collected generation when the cycle started
+    size_t survivorBytes;            // bytes of the collected generation that survived; survivor rate = survivorBytes / collectedGenerationBytes
+    size_t barrierShadedObjects;     // objects greyed by write barriers during marking
+} objc_collection_stats_t;
+
 /* objc_clear_stack() options */
 enum {
     OBJC_CLEAR_RESIDENT_STACK = (1 << 0)
@@ -89,6 +112,18 @@ OBJC_EXPORT void objc_setCollectionThreshold(size_t threshold)
 OBJC_EXPORT void objc_setCollectionRatio(size_t ratio)
     __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_NA);
 
+/* Sets the longest pause, in nanoseconds, of one OBJC_INCREMENTAL_COLLECTION slice. The default is 1 ms. */
+OBJC_EXPORT void objc_setCollectionSliceBudget(uint64_t nanoseconds)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_NA);
+
+/* Runs one slice of the current incremental collection, starting a new one if none is in progress.  Returns YES once the cycle has finished. */
+OBJC_EXPORT BOOL objc_collectSlice(uint64_t budgetNanoseconds)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_NA);
+
+/* Copies the statistics of the most recent completed cycles, newest first.  Returns the number of entries written to buffer. */
+OBJC_EXPORT unsigned int objc_getCollectionStatistics(objc_collection_stats_t *buffer, unsigned int count)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_NA);
+
 // 
 // GC-safe compare-and-swap
 //
@@ -115,6 +150,10 @@ OBJC_EXPORT BOOL objc_atomicCompareAndSwapInstanceVariableBarrier(id predicate,
 // 
 // Read and write barriers
 // 
+// While an incremental collection is marking, the assign barriers also grey 
+// the object being stored, so the collector never misses a reference 
+// written into an already scanned (black) object.
+// 
 
 OBJC_EXPORT id objc_assign_strongCast(id val, id *dest)
     __OSX_AVAILABLE_STARTING(__MAC_10_4, __IPHONE_NA);
@@ -209,6 +248,9 @@ static OBJC_INLINE malloc_zone_t *objc_collectableZone(void) { return nil; }
 #endif
 static OBJC_INLINE void objc_setCollectionThreshold(size_t threshold __unused) { }
 static OBJC_INLINE void objc_setCollectionRatio(size_t ratio __unused) { }
+static OBJC_INLINE void objc_setCollectionSliceBudget(uint64_t nanoseconds __unused) { }
+static OBJC_INLINE BOOL objc_collectSlice(uint64_t budgetNanoseconds __unused) { return YES; }
+static OBJC_INLINE unsigned int objc_getCollectionStatistics(objc_collection_stats_t *buffer __unused, unsigned int count __unused) { return 0; }
 static OBJC_INLINE void objc_startCollectorThread(void) { }
 
 #if __has_feature(objc_arc)
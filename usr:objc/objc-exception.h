@@ -100,6 +100,40 @@ OBJC_EXPORT uintptr_t objc_addExceptionHandler(objc_exception_handler fn, void *
 OBJC_EXPORT void objc_removeExceptionHandler(uintptr_t token)
     __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_NA);
 
+// Each thread reserves an emergency pool that exception objects and unwinding 
+// state are carved from when malloc fails, so a throw still succeeds under 
+// memory pressure. Sets the size of the pools of threads started afterwards.
+OBJC_EXPORT void objc_exception_setEmergencyPoolSize(size_t bytes)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+// Allocates memory for exception state that must survive malloc failure, 
+// falling back to the calling thread's emergency pool. Returns NULL only when 
+// both are exhausted. objc_exception_throw uses it for the unwinding state it 
+// wraps around the thrown object and for the return addresses it records; 
+// the thrown object itself is allocated however its class allocates it 
+// (+alloc for NSException). A root class may also use it for its instances, 
+// in which case its deallocation path must call objc_exception_free() in 
+// place of free() or object_dispose(). 
+OBJC_EXPORT void *objc_exception_allocate(size_t size)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+// Releases memory from objc_exception_allocate(), returning emergency pool 
+// blocks to the pool they came from. May be called on any thread, including 
+// one other than the thread that allocated the block. Passing such memory 
+// to free() is undefined.
+OBJC_EXPORT void objc_exception_free(void *ptr)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+// objc_exception_throw records the throw site as raw return addresses in a 
+// side table keyed by the thrown object, for any object however it was 
+// allocated; nothing is symbolized at throw time. A nested throw of another 
+// object does not disturb the entry, and rethrowing the same object keeps the 
+// original addresses. The entry is removed when the object is deallocated. 
+// Copies up to count of them into buffer and returns how many were copied, 
+// or 0 if exception has never been thrown.
+OBJC_EXPORT unsigned int objc_exception_getReturnAddresses(id exception, void **buffer, unsigned int count)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 // __OBJC2__
 #endif
 
@@ -34,6 +34,8 @@
 
 /* dynamically loading Mach-O object files that contain Objective-C code */
 
+/* objc_loadModules parses the modules in modlist and fixes up their selectors in parallel on a pool of worker threads; classes and categories are then attached in modlist order.  A loaded class is realized (its method lists attached and its cache created) only when it receives its first message, so class_callback may be called with classes that are not yet realized. */
+
 OBJC_EXPORT long objc_loadModules (
 	char *modlist[], 
 	void *errStream,
@@ -51,4 +53,21 @@ OBJC_EXPORT long objc_unloadModules(
 	void (*unloadCallback)(Class, Category)		/* input (optional) */
 ) OBJC2_UNAVAILABLE;
 
+/* per-module load timing, reported once for every module loaded by objc_loadModules or objc_loadModule */
+struct objc_module_load_info {
+	const char *moduleName;
+	unsigned int classCount;
+	unsigned int selectorCount;
+	unsigned long long parseNanoseconds;	/* reading the image and its Objective-C sections */
+	unsigned long long fixupNanoseconds;	/* uniquing selectors and fixing up references */
+	unsigned long long attachNanoseconds;	/* registering classes and attaching categories */
+};
+
+OBJC_EXPORT void objc_setModuleLoadCallback (
+	void (*loadCallback)(const struct objc_module_load_info *info)	/* input (optional) */
+) OBJC2_UNAVAILABLE;
+OBJC_EXPORT void objc_setModuleLoadConcurrency (
+	unsigned int workerCount	/* 0 selects one worker per CPU, 1 loads serially */
+) OBJC2_UNAVAILABLE;
+
 #endif /* _OBJC_LOAD_H_ */
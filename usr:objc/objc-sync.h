@@ -29,7 +29,17 @@
 
 /** 
  * Begin synchronizing on 'obj'.  
- * Allocates recursive pthread_mutex associated with 'obj' if needed.
+ * The packed isa has no room for lock bits, so the lock word lives in a
+ * lock record allocated the first time 'obj' is synchronized on, found through
+ * a lock-free hash table keyed by address and separate from the reference
+ * count side tables. Each thread also caches the records it owns, so
+ * re-entry by the owner does not touch the shared table at all.
+ * A new record is biased to the thread that creates it: the owner enters and
+ * exits by adjusting its recursion count with plain stores, with no atomic
+ * operation. Another thread that wants the lock revokes the bias by briefly
+ * suspending the owner and reading its recursion count, then inflates the
+ * record to a futex-backed monitor; objc_sync_wait/objc_sync_notify also
+ * inflate it. An inflated record is never biased again.
  * 
  * @param obj The object to begin synchronizing on.
  * 
@@ -48,13 +58,68 @@ OBJC_EXPORT  int objc_sync_enter(id obj)
 OBJC_EXPORT  int objc_sync_exit(id obj)
     __OSX_AVAILABLE_STARTING(__MAC_10_3, __IPHONE_2_0);
 
-// The wait/notify functions have never worked correctly and no longer exist.
+/** 
+ * Wait on the monitor of 'obj', which the calling thread must own.
+ * Inflates the lock to a full monitor if needed, releases it while waiting,
+ * and reacquires it with the original recursion count before returning.
+ * 
+ * @param obj The object to wait on.
+ * @param milliSecondsMaxWait The maximum time to wait, or a negative value to wait forever.
+ * 
+ * @return OBJC_SYNC_SUCCESS when notified, OBJC_SYNC_TIMED_OUT, 
+ *  or OBJC_SYNC_NOT_OWNING_THREAD_ERROR
+ */
 OBJC_EXPORT  int objc_sync_wait(id obj, long long milliSecondsMaxWait) 
-    UNAVAILABLE_ATTRIBUTE;
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Wake one thread waiting on the monitor of 'obj'.
+ * 
+ * @param obj The object to notify. The calling thread must own its lock.
+ * 
+ * @return OBJC_SYNC_SUCCESS or OBJC_SYNC_NOT_OWNING_THREAD_ERROR
+ */
 OBJC_EXPORT  int objc_sync_notify(id obj) 
-    UNAVAILABLE_ATTRIBUTE;
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Wake every thread waiting on the monitor of 'obj'.
+ * 
+ * @param obj The object to notify. The calling thread must own its lock.
+ * 
+ * @return OBJC_SYNC_SUCCESS or OBJC_SYNC_NOT_OWNING_THREAD_ERROR
+ */
 OBJC_EXPORT  int objc_sync_notifyAll(id obj) 
-    UNAVAILABLE_ATTRIBUTE;
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/// Contention statistics for one synchronized object.
+typedef struct {
+    __unsafe_unretained id object;  /**< The synchronized object; may since have been deallocated. */
+    const char *className;          /**< The class name of \e object when it was first contended. */
+    unsigned long long contendedEnters; /**< Entries that found the lock held by another thread. */
+    unsigned long long waitNanoseconds; /**< Total time threads spent blocked on the lock. */
+    unsigned long long inflations;  /**< Times the lock word was inflated to a monitor. */
+} objc_sync_contention_t;
+
+/** 
+ * Returns the most contended synchronized objects, hottest first.
+ * 
+ * @param maxCount The maximum number of records to return.
+ * @param outCount On return, the number of records in the returned array.
+ * 
+ * @return A C array of contention records, ordered by decreasing \e waitNanoseconds.
+ *  You must free the array with \c free(). Returns \c NULL if no lock has been contended.
+ * 
+ * @note Contention is only recorded for locks that have been inflated.
+ */
+OBJC_EXPORT objc_sync_contention_t *objc_sync_copyContentionReport(unsigned int maxCount, unsigned int *outCount)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Discards all contention statistics gathered so far.
+ */
+OBJC_EXPORT void objc_sync_resetContentionReport(void)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
 
 enum {
 	OBJC_SYNC_SUCCESS                 = 0,
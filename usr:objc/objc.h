@@ -29,8 +29,7 @@
 #define _OBJC_OBJC_H_
 
 #include <sys/types.h>      // for __DARWIN_NULL
-#include <Availability.h>
-#include <objc/objc-api.h>
+#include <objc/objc-api.h>     // for Availability.h and TargetConditionals.h
 #include <stdbool.h>
 
 #if !OBJC_TYPES_DEFINED
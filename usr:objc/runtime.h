@@ -39,8 +39,6 @@
 #include <stdarg.h>
 #include <stdint.h>
 #include <stddef.h>
-#include <Availability.h>
-#include <TargetConditionals.h>
 
 #if TARGET_OS_MAC
 #include <sys/types.h>
@@ -116,6 +114,26 @@ typedef struct {
 
 /* Working with Instances */
 
+/// Statistics for inline (packed isa) and side table reference counts.
+typedef struct objc_refcount_statistics {
+    unsigned long long inlineRetains;   /**< Retains satisfied by a CAS on the isa word. */
+    unsigned long long inlineReleases;  /**< Releases satisfied by a CAS on the isa word. */
+    unsigned long long spills;          /**< Times an inline count overflowed into the side table. */
+    unsigned long long sideTableRetains;  /**< Retains that went to the side table. */
+    unsigned long long sideTableReleases; /**< Releases that went to the side table. */
+    size_t sideTableObjects;            /**< Objects currently holding a side table refcount. */
+} objc_refcount_statistics_t;
+
+/** 
+ * Returns reference counting statistics for the whole process.
+ * 
+ * @param outStatistics On return, a snapshot of the reference counting statistics.
+ * 
+ * @note Counts are kept per thread and summed on demand.
+ */
+OBJC_EXPORT void objc_getRefcountStatistics(objc_refcount_statistics_t *outStatistics)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 /** 
  * Returns a copy of a given object.
  * 
@@ -146,6 +164,9 @@ OBJC_EXPORT id object_dispose(id obj)
  * 
  * @return The class object of which \e object is an instance, 
  *  or \c Nil if \e object is \c nil.
+ * 
+ * @note When \c OBJC_PACKED_ISA is set, the isa field also holds the inline retain
+ *  count and flags, so the class must be read with this function.
  */
 OBJC_EXPORT Class object_getClass(id obj) 
      __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_2_0);
@@ -260,6 +281,81 @@ OBJC_EXPORT Ivar object_getInstanceVariable(id obj, const char *name, void **out
     __OSX_AVAILABLE_STARTING(__MAC_10_0, __IPHONE_2_0)
     OBJC_ARC_UNAVAILABLE;
 
+/* Typed ivar access by offset
+ *
+ * These functions read or write an instance variable at an offset obtained
+ * once with ivar_getOffset(class_getInstanceVariable(cls, name)), and compile
+ * to a single load or store. The offset of an ivar does not change after its
+ * class is registered, so it can be cached for the lifetime of the process.
+ *
+ * They perform no type or nil checks and, except for 
+ * object_setStrongIdIvarAtOffset, no memory management. 
+ * object_setUnretainedIdIvarAtOffset neither retains nor releases, so use it 
+ * only for __unsafe_unretained ivars; storing into a strong ivar with it 
+ * over-releases the new value and leaks the old one when the object is 
+ * destroyed. Use object_setStrongIdIvarAtOffset for strong ivars.
+ */
+#if __has_feature(objc_arc)
+#   define _OBJC_IVAR_ADDRESS(_type, _obj, _offset) \
+        ((_type *)((char *)(__bridge void *)(_obj) + (_offset)))
+#else
+#   define _OBJC_IVAR_ADDRESS(_type, _obj, _offset) \
+        ((_type *)((char *)(void *)(_obj) + (_offset)))
+#endif
+
+static OBJC_INLINE id object_getIdIvarAtOffset(id obj, ptrdiff_t offset) 
+    { return *_OBJC_IVAR_ADDRESS(__unsafe_unretained id, obj, offset); }
+static OBJC_INLINE void object_setUnretainedIdIvarAtOffset(id obj, ptrdiff_t offset, id value) 
+    { *_OBJC_IVAR_ADDRESS(__unsafe_unretained id, obj, offset) = value; }
+
+static OBJC_INLINE void *object_getPointerIvarAtOffset(id obj, ptrdiff_t offset) 
+    { return *_OBJC_IVAR_ADDRESS(void *, obj, offset); }
+static OBJC_INLINE void object_setPointerIvarAtOffset(id obj, ptrdiff_t offset, void *value) 
+    { *_OBJC_IVAR_ADDRESS(void *, obj, offset) = value; }
+
+static OBJC_INLINE BOOL object_getBoolIvarAtOffset(id obj, ptrdiff_t offset) 
+    { return *_OBJC_IVAR_ADDRESS(BOOL, obj, offset); }
+static OBJC_INLINE void object_setBoolIvarAtOffset(id obj, ptrdiff_t offset, BOOL value) 
+    { *_OBJC_IVAR_ADDRESS(BOOL, obj, offset) = value; }
+
+static OBJC_INLINE int object_getIntIvarAtOffset(id obj, ptrdiff_t offset) 
+    { return *_OBJC_IVAR_ADDRESS(int, obj, offset); }
+static OBJC_INLINE void object_setIntIvarAtOffset(id obj, ptrdiff_t offset, int value) 
+    { *_OBJC_IVAR_ADDRESS(int, obj, offset) = value; }
+
+static OBJC_INLINE long object_getLongIvarAtOffset(id obj, ptrdiff_t offset) 
+    { return *_OBJC_IVAR_ADDRESS(long, obj, offset); }
+static OBJC_INLINE void object_setLongIvarAtOffset(id obj, ptrdiff_t offset, long value) 
+    { *_OBJC_IVAR_ADDRESS(long, obj, offset) = value; }
+
+static OBJC_INLINE long long object_getLongLongIvarAtOffset(id obj, ptrdiff_t offset) 
+    { return *_OBJC_IVAR_ADDRESS(long long, obj, offset); }
+static OBJC_INLINE void object_setLongLongIvarAtOffset(id obj, ptrdiff_t offset, long long value) 
+    { *_OBJC_IVAR_ADDRESS(long long, obj, offset) = value; }
+
+static OBJC_INLINE float object_getFloatIvarAtOffset(id obj, ptrdiff_t offset) 
+    { return *_OBJC_IVAR_ADDRESS(float, obj, offset); }
+static OBJC_INLINE void object_setFloatIvarAtOffset(id obj, ptrdiff_t offset, float value) 
+    { *_OBJC_IVAR_ADDRESS(float, obj, offset) = value; }
+
+static OBJC_INLINE double object_getDoubleIvarAtOffset(id obj, ptrdiff_t offset) 
+    { return *_OBJC_IVAR_ADDRESS(double, obj, offset); }
+static OBJC_INLINE void object_setDoubleIvarAtOffset(id obj, ptrdiff_t offset, double value) 
+    { *_OBJC_IVAR_ADDRESS(double, obj, offset) = value; }
+
+#undef _OBJC_IVAR_ADDRESS
+
+/** 
+ * Stores \e value in a strong instance variable at \e offset, retaining 
+ * \e value and releasing the previous value, like objc_storeStrong().
+ * 
+ * @param obj The object containing the instance variable.
+ * @param offset The ivar's offset, from ivar_getOffset().
+ * @param value The new value.
+ */
+OBJC_EXPORT void object_setStrongIdIvarAtOffset(id obj, ptrdiff_t offset, id value)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 
 /* Obtaining Class Definitions */
 
@@ -459,6 +555,10 @@ OBJC_EXPORT size_t class_getInstanceSize(Class cls)
  * 
  * @return A pointer to an \c Ivar data structure containing information about 
  *  the instance variable specified by \e name.
+ * 
+ * @note Names are looked up in a per-class hash index, built on first use and 
+ *  covering the ivars of \e cls and its superclasses. \c object_getInstanceVariable 
+ *  and \c object_setInstanceVariable use the same index.
  */
 OBJC_EXPORT Ivar class_getInstanceVariable(Class cls, const char *name)
     __OSX_AVAILABLE_STARTING(__MAC_10_0, __IPHONE_2_0);
@@ -535,6 +635,8 @@ OBJC_EXPORT Method class_getClassMethod(Class cls, SEL name)
  * @note The function pointer returned may be a function internal to the runtime instead of
  *  an actual method implementation. For example, if instances of the class do not respond to
  *  the selector, the function pointer returned will be part of the runtime's message forwarding machinery.
+ * @note The lookup goes through the same per-class method cache as \c objc_msgSend. 
+ *  Cache hits take no lock and may run concurrently with cache growth and flushes.
  */
 OBJC_EXPORT IMP class_getMethodImplementation(Class cls, SEL name) 
      __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_2_0);
@@ -567,6 +669,38 @@ OBJC_EXPORT IMP class_getMethodImplementation_stret(Class cls, SEL name)
 OBJC_EXPORT BOOL class_respondsToSelector(Class cls, SEL sel) 
      __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_2_0);
 
+/// Statistics for the method cache of one class.
+typedef struct objc_cache_statistics {
+    unsigned long long hits;        /**< Lookups answered by the cache. */
+    unsigned long long misses;      /**< Lookups that fell back to the method lists. */
+    unsigned long long flushes;     /**< Times the cache was emptied by a method list change. */
+    unsigned int capacity;          /**< Current number of cache slots. */
+    unsigned int occupied;          /**< Slots currently holding a selector. */
+} objc_cache_statistics_t;
+
+/** 
+ * Returns the method cache statistics of a class.
+ * 
+ * @param cls The class you want to inspect.
+ * @param outStatistics On return, the cache statistics of \e cls.
+ * 
+ * @return \c YES if \e outStatistics was filled in, \c NO if \e cls is \c Nil.
+ * 
+ * @note Hit and miss counts are kept per thread and summed on demand, so they 
+ *  may lag concurrent lookups slightly.
+ * @note Pass \c object_getClass(cls) to inspect the class method cache.
+ */
+OBJC_EXPORT BOOL class_getCacheStatistics(Class cls, objc_cache_statistics_t *outStatistics)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Resets the hit, miss and flush counts of a class's method cache to zero.
+ * 
+ * @param cls The class whose counters you want to reset.
+ */
+OBJC_EXPORT void class_resetCacheStatistics(Class cls)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 /** 
  * Describes the instance methods implemented by a class.
  * 
@@ -596,6 +730,13 @@ OBJC_EXPORT Method *class_copyMethodList(Class cls, unsigned int *outCount)
  * @return YES if cls conforms to protocol, otherwise NO.
  *
  * @note You should usually use NSObject's conformsToProtocol: method instead of this function.
+ * @note The answer is memoized per class in a bitset indexed by each protocol's dense index,
+ *  which covers the protocols the class itself adopts (including through its categories) and
+ *  everything they inherit, but not those of its superclasses. After the first query for a class,
+ *  further queries are a single bit test; NSObject's conformsToProtocol: does one bit test per
+ *  class in the superclass chain. Because no bitset includes a superclass's protocols, only
+ *  the bitset of \e cls itself is discarded when \c class_addProtocol is called on it or a
+ *  category is attached to it; its subclasses' bitsets stay valid.
  */
 OBJC_EXPORT BOOL class_conformsToProtocol(Class cls, Protocol *protocol) 
      __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_2_0);
@@ -645,6 +786,78 @@ OBJC_EXPORT objc_property_t class_getProperty(Class cls, const char *name)
 OBJC_EXPORT objc_property_t *class_copyPropertyList(Class cls, unsigned int *outCount)
      __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_2_0);
 
+/** 
+ * Calls a function for each instance method implemented by a class, 
+ * without copying the method list.
+ * 
+ * @param cls The class you want to inspect.
+ * @param callback The function to call. Set \e *stop to \c YES to end the enumeration early.
+ * @param context A pointer passed unchanged to \e callback.
+ * 
+ * @note Methods are visited in the same order as \c class_copyMethodList returns them.
+ *  Any instance methods implemented by superclasses are not included.
+ * @note The runtime lock is not held while \e callback runs, but methods added to \e cls 
+ *  during the enumeration may or may not be visited.
+ */
+OBJC_EXPORT void class_enumerateMethods(Class cls, void (*callback)(Method m, void *context, BOOL *stop), void *context)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Calls a function for each instance variable declared by a class, 
+ * without copying the ivar list.
+ * 
+ * @param cls The class you want to inspect.
+ * @param callback The function to call. Set \e *stop to \c YES to end the enumeration early.
+ * @param context A pointer passed unchanged to \e callback.
+ * 
+ * @note Any instance variables declared by superclasses are not included.
+ *  Use \c class_getFlattenedIvarList to include them.
+ */
+OBJC_EXPORT void class_enumerateIvars(Class cls, void (*callback)(Ivar v, void *context, BOOL *stop), void *context)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Calls a function for each property declared by a class, 
+ * without copying the property list.
+ * 
+ * @param cls The class you want to inspect.
+ * @param callback The function to call. Set \e *stop to \c YES to end the enumeration early.
+ * @param context A pointer passed unchanged to \e callback.
+ * 
+ * @note Any properties declared by superclasses are not included.
+ */
+OBJC_EXPORT void class_enumerateProperties(Class cls, void (*callback)(objc_property_t property, void *context, BOOL *stop), void *context)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Calls a function for each protocol adopted by a class, 
+ * without copying the protocol list.
+ * 
+ * @param cls The class you want to inspect.
+ * @param callback The function to call. Set \e *stop to \c YES to end the enumeration early.
+ * @param context A pointer passed unchanged to \e callback.
+ * 
+ * @note Any protocols adopted by superclasses or other protocols are not included.
+ */
+OBJC_EXPORT void class_enumerateProtocols(Class cls, void (*callback)(Protocol *protocol, void *context, BOOL *stop), void *context)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Returns every instance variable of a class, including those declared by 
+ * its superclasses, in increasing offset order.
+ * 
+ * @param cls The class you want to inspect.
+ * @param outCount On return, contains the length of the returned array. 
+ *  If outCount is NULL, the length is not returned.
+ * 
+ * @return An array of \e *outCount pointers of type Ivar, or \c NULL if the class has no ivars.
+ *  The array is owned by the runtime and stays valid for the lifetime of \e cls; do not free it.
+ * 
+ * @note The array is built on the first call and cached with the class.
+ */
+OBJC_EXPORT Ivar const *class_getFlattenedIvarList(Class cls, unsigned int *outCount)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 /** 
  * Returns a description of the \c Ivar layout for a given class.
  * 
@@ -679,6 +892,8 @@ OBJC_EXPORT const uint8_t *class_getWeakIvarLayout(Class cls)
  * @note class_addMethod will add an override of a superclass's implementation, 
  *  but will not replace an existing implementation in this class. 
  *  To change an existing implementation, use method_setImplementation.
+ * @note The method caches of \e cls and its subclasses are flushed for \e name. A replaced cache
+ *  is reclaimed once every thread that could still be reading it has passed a quiescent point.
  */
 OBJC_EXPORT BOOL class_addMethod(Class cls, SEL name, IMP imp, 
                                  const char *types) 
@@ -701,6 +916,7 @@ OBJC_EXPORT BOOL class_addMethod(Class cls, SEL name, IMP imp,
  *    The type encoding specified by \e types is used as given.
  *  - If the method identified by \e name does exist, its \c IMP is replaced as if \c method_setImplementation were called.
  *    The type encoding specified by \e types is ignored.
+ * @note The method caches of \e cls and its subclasses are flushed for \e name.
  */
 OBJC_EXPORT IMP class_replaceMethod(Class cls, SEL name, IMP imp, 
                                     const char *types) 
@@ -731,6 +947,8 @@ OBJC_EXPORT BOOL class_addIvar(Class cls, const char *name, size_t size,
  * 
  * @return \c YES if the method was added successfully, otherwise \c NO 
  *  (for example, the class already conforms to that protocol).
+ * 
+ * @note Invalidates the memoized protocol conformance of \e cls only (see \c class_conformsToProtocol).
  */
 OBJC_EXPORT BOOL class_addProtocol(Class cls, Protocol *protocol) 
      __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_2_0);
@@ -875,6 +1093,31 @@ OBJC_EXPORT Class objc_allocateClassPair(Class superclass, const char *name,
 OBJC_EXPORT void objc_registerClassPair(Class cls) 
      __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_2_0);
 
+/** 
+ * Registers several classes that were allocated using \c objc_allocateClassPair.
+ * 
+ * @param classes An array of the classes you want to register.
+ * @param count The number of classes in \e classes.
+ * 
+ * @note All classes are published under a single acquisition of the runtime lock 
+ *  and a single method cache flush, instead of one per class. No class in the batch 
+ *  becomes visible to \c objc_getClass before the others.
+ * @note Methods, ivars and protocols added to a class before it is registered do not 
+ *  take the runtime lock or flush any cache, so a batch of classes can be built with
+ *  \c class_addMethod, \c class_addIvar and \c class_addProtocol and then published 
+ *  with one call to this function.
+ * @return \c YES if every class was registered. \c NO if any class in \e classes fails 
+ *  validation, in which case no class is registered and every class remains allocated but 
+ *  unregistered, so it can be fixed or passed to \c objc_disposeClassPair. Validation fails when:
+ *  - a class is already registered, or appears in \e classes more than once;
+ *  - a class's superclass is neither registered nor earlier in \e classes;
+ *  - a class's name matches a registered class or another class in \e classes.
+ * 
+ * @note Superclasses that are themselves in the batch must appear before their subclasses.
+ */
+OBJC_EXPORT BOOL objc_registerClassPairs(Class const *classes, unsigned int count) 
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 /** 
  * Used by Foundation's Key-Value Observing.
  * 
@@ -1016,6 +1259,7 @@ OBJC_EXPORT IMP method_setImplementation(Method m, IMP imp)
  *  method_setImplementation(m1, imp2);
  *  method_setImplementation(m2, imp1);
  *  \endcode
+ * @note Every method cache holding either method's selector is flushed.
  */
 OBJC_EXPORT void method_exchangeImplementations(Method m1, Method m2) 
      __OSX_AVAILABLE_STARTING(__MAC_10_5, __IPHONE_2_0);
@@ -1269,6 +1513,11 @@ OBJC_EXPORT Protocol *objc_allocateProtocol(const char *name)
  * Registers a newly constructed protocol with the runtime. The protocol
  * will be ready for use and is immutable after this.
  * 
+ * @note Registration assigns the protocol the dense index used by the 
+ *  conformance cache of \c class_conformsToProtocol. Protocols compiled into an image 
+ *  never come through here; they are assigned theirs when the image is loaded, as its 
+ *  protocol list is read.
+ * 
  * @param proto The protocol you want to register.
  */
 OBJC_EXPORT void objc_registerProtocol(Protocol *proto) 
@@ -1372,6 +1621,8 @@ OBJC_EXPORT const char *sel_getName(SEL sel)
  * @note Prior to OS X version 10.0, this method tried to find the selector mapped to the given name
  *  and returned \c NULL if the selector was not found. This was changed for safety, because it was
  *  observed that many of the callers of this function did not check the return value for \c NULL.
+ * @note Names present in a registered selector table (see \c sel_registerTable) are resolved
+ *  without taking any lock.
  */
 OBJC_EXPORT SEL sel_getUid(const char *str)
     __OSX_AVAILABLE_STARTING(__MAC_10_0, __IPHONE_2_0);
@@ -1387,10 +1638,61 @@ OBJC_EXPORT SEL sel_getUid(const char *str)
  * @note You must register a method name with the Objective-C runtime system to obtain the
  *  method’s selector before you can add the method to a class definition. If the method name
  *  has already been registered, this function simply returns the selector.
+ * @note Names present in a registered selector table (see \c sel_registerTable) are resolved
+ *  without taking any lock. Other names go through a concurrent table in which looking up an
+ *  already registered name is also lock-free; only the first registration of a name locks.
  */
 OBJC_EXPORT SEL sel_registerName(const char *str)
     __OSX_AVAILABLE_STARTING(__MAC_10_0, __IPHONE_2_0);
 
+/// The version of \c objc_selector_table_t understood by this runtime.
+#define OBJC_SELECTOR_TABLE_VERSION 1
+
+/** 
+ * A precomputed, read-only table of selector names.
+ * 
+ * The table is a minimal perfect hash generated at build time from every selector
+ * name known to an image. A name is hashed with 64-bit FNV-1a; the low 32 bits select
+ * a displacement, and the name's slot is \c (high32 + displacements[low32 % bucketCount]) % count,
+ * where the addition is done in 64-bit unsigned arithmetic (\c uint64_t) so it never wraps.
+ * A name absent from the table also maps to some slot, so a lookup compares the name stored there.
+ * The generated table is \c const data, so it is shared read-only between processes.
+ */
+typedef struct objc_selector_table {
+    uint32_t version;               /**< Must be \c OBJC_SELECTOR_TABLE_VERSION. */
+    uint32_t count;                 /**< Number of entries in \e names. Must not be 0. */
+    uint32_t bucketCount;           /**< Number of entries in \e displacements. Must not be 0. */
+    uint32_t reserved;              /**< Must be 0. */
+    const uint32_t *displacements;
+    const char * const *names;      /**< Selector names, in perfect hash slot order. */
+} objc_selector_table_t;
+
+/** 
+ * Registers a precomputed selector table with the Objective-C runtime system.
+ * 
+ * @param table A table generated at build time. It must remain valid for the 
+ *  lifetime of the process.
+ * 
+ * @param outNewCount On return, if not \c NULL and the table was accepted, the number of names 
+ *  in \e table that were not already registered. May be 0.
+ * 
+ * @return \c YES if the table was registered. \c NO if \e table has an unsupported version, 
+ *  a zero \e count or \e bucketCount, or a non-zero \e reserved field; nothing is registered then.
+ * 
+ * @note Call this from an image initializer, before the image registers any selector dynamically.
+ *  Names that were already registered keep their existing \c SEL. To make that possible the runtime
+ *  allocates one \c SEL per slot when the table is registered, fills it in under the selector lock
+ *  (the existing \c SEL, or the name from \e table), and only then publishes the table with a
+ *  release store. The array is never written again, so lookups through it, including those of
+ *  previously registered names, read it without a lock.
+ * @note Each image may register its own table. A lookup hashes the name once and probes the tables
+ *  in registration order, stopping at the first match; each probe costs two loads and one string
+ *  comparison, so a name found in none of them costs one probe per registered table before it
+ *  falls back to the dynamic table.
+ */
+OBJC_EXPORT BOOL sel_registerTable(const objc_selector_table_t *table, unsigned int *outNewCount)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 /** 
  * Returns a Boolean value that indicates whether two selectors are equal.
  * 
@@ -1449,6 +1751,9 @@ OBJC_EXPORT void objc_setForwardHandler(void *fwd, void *fwd_stret)
  * 
  * @return The IMP that calls this block. Must be disposed of with
  *  \c imp_removeBlock.
+ * 
+ * @note Trampolines are taken from pools of pre-mapped trampoline pages through a 
+ *  lock-free free list; a new page is mapped only when every pool is exhausted.
  */
 OBJC_EXPORT IMP imp_implementationWithBlock(id block)
      __OSX_AVAILABLE_STARTING(__MAC_10_7, __IPHONE_4_3);
@@ -1477,6 +1782,46 @@ OBJC_EXPORT id imp_getBlock(IMP anImp)
 OBJC_EXPORT BOOL imp_removeBlock(IMP anImp)
      __OSX_AVAILABLE_STARTING(__MAC_10_7, __IPHONE_4_3);
 
+/** 
+ * Creates one IMP per block, as if \c imp_implementationWithBlock were called 
+ * for each of them, reserving all the trampolines at once.
+ * 
+ * @param blocks The blocks that implement the methods.
+ * @param outImps On return, the IMPs that call the corresponding blocks. 
+ *  Each must be disposed of with \c imp_removeBlock or \c imp_removeBlocks.
+ * @param count The number of entries in \e blocks and \e outImps.
+ */
+OBJC_EXPORT void imp_implementationsWithBlocks(id const *blocks, IMP *outImps, unsigned int count)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/** 
+ * Disassociates several IMPs created with \c imp_implementationWithBlock 
+ * from their blocks, as if \c imp_removeBlock were called for each of them.
+ * 
+ * @param imps The IMPs to dispose of.
+ * @param count The number of entries in \e imps.
+ * 
+ * @return The number of IMPs whose block was released successfully.
+ */
+OBJC_EXPORT unsigned int imp_removeBlocks(IMP const *imps, unsigned int count)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
+/// Usage statistics for block trampolines.
+typedef struct objc_trampoline_statistics {
+    size_t pagesMapped;             /**< Trampoline pages currently mapped. */
+    size_t pagesInUse;              /**< Mapped pages with at least one live trampoline. */
+    size_t trampolinesInUse;        /**< IMPs created and not yet removed. */
+    size_t trampolinesFree;         /**< Trampolines available without mapping a new page. */
+} objc_trampoline_statistics_t;
+
+/** 
+ * Returns usage statistics for the block trampoline pools.
+ * 
+ * @param outStatistics On return, a snapshot of the trampoline statistics.
+ */
+OBJC_EXPORT void imp_getTrampolineStatistics(objc_trampoline_statistics_t *outStatistics)
+     __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 /** 
  * This loads the object referenced by a weak pointer and returns it, after
  * retaining and autoreleasing the object to ensure that it stays alive
@@ -1498,10 +1843,38 @@ OBJC_EXPORT id objc_loadWeak(id *location)
  * @param obj The new object this weak ptr should now point to
  * 
  * @return The value stored into \e location, i.e. \e obj
+ * 
+ * @note Weak references are recorded in a side table striped by object address.
+ *  Each object keeps its referrers inline while there are only a few, and in a
+ *  hash set once there are more. When the object is deallocated, its whole 
+ *  referrer set is cleared in a single pass under one stripe lock.
  */
 OBJC_EXPORT id objc_storeWeak(id *location, id obj) 
     __OSX_AVAILABLE_STARTING(__MAC_10_7, __IPHONE_5_0);
 
+/// Statistics for the weak reference side table.
+typedef struct objc_weak_statistics {
+    size_t referencedObjects;       /**< Objects that currently have weak referrers. */
+    size_t referrers;               /**< Weak locations currently registered. */
+    size_t inlineReferrerSets;      /**< Referrer sets still using inline storage. */
+    size_t tableBytes;              /**< Memory used by the side table and its referrer sets. */
+    unsigned long long clears;      /**< Referrer sets cleared by deallocation. */
+    unsigned long long clearedReferrers; /**< Weak locations zeroed by those clears. */
+    unsigned long long clearNanoseconds; /**< Total time spent clearing referrer sets. */
+    unsigned long long maxClearNanoseconds; /**< Longest single clear. */
+} objc_weak_statistics_t;
+
+/** 
+ * Returns statistics for the weak reference side table.
+ * 
+ * @param outStatistics On return, a snapshot of the weak table statistics.
+ * 
+ * @note Stripes are sampled one at a time, so the snapshot is not atomic 
+ *  with respect to concurrent \c objc_storeWeak calls.
+ */
+OBJC_EXPORT void objc_getWeakStatistics(objc_weak_statistics_t *outStatistics)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 
 /* Associative References */
 
@@ -1535,6 +1908,9 @@ typedef OBJC_ENUM(uintptr_t, objc_AssociationPolicy) {
  * @param key        一个 void 指针，对于每个关联，key必须唯一，通常可以使用一个 static variable.
  * @param value     关联的对象。
  * @param policy    关联策略,用来指定，关联的对象是 assigned, retained, copied, 还有是否是atomically.
+ *
+ * 关联表按对象地址分片(shard)，每个分片有自己的锁，不同对象的关联互不争用;
+ * 每个对象的前几个(1~3个)关联直接内联存放，不额外分配内存，超过之后才使用哈希表。
  */
 OBJC_EXPORT void objc_setAssociatedObject(id object, const void *key, id value, objc_AssociationPolicy policy)
     __OSX_AVAILABLE_STARTING(__MAC_10_6, __IPHONE_3_1);
@@ -1557,6 +1933,17 @@ OBJC_EXPORT id objc_getAssociatedObject(id object, const void *key)
 OBJC_EXPORT void objc_removeAssociatedObjects(id object)
     __OSX_AVAILABLE_STARTING(__MAC_10_6, __IPHONE_3_1);
 
+/** 
+ * 批量断开一组对象的所有关联，效果等同于对每个对象调用objc_removeAssociatedObjects。
+ * 对象按分片归组，每个分片只加一次锁，被关联对象的release在所有锁释放之后统一进行。
+ * 运行时在对象dispose时也走这条路径。
+ *
+ * @param objects   需要断开关联的源对象数组，可以包含nil。
+ * @param count     objects中的对象个数。
+ */
+OBJC_EXPORT void objc_removeAssociatedObjectsBatch(id const *objects, unsigned int count)
+    __OSX_AVAILABLE_STARTING(__MAC_10_11, __IPHONE_9_0);
+
 
 #define _C_ID       '@'
 #define _C_CLASS    '#'